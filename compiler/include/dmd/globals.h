@@ -186,6 +186,8 @@ struct Param
     d_bool multiobj;      // break one object file into multiple ones
     d_bool trace;         // insert profiling hooks
     d_bool tracegc;       // instrument calls to 'new'
+    d_bool profileCtfe;   // report time and allocations of CTFE calls
+    d_bool lazyBodies;    // run semantic3 on root function bodies only when needed
     d_bool vcg_ast;       // write-out codegen-ast
     d_bool useUnitTests;  // generate unittest code
     d_bool useUnitTestsRootOnly; // generate unittest code for root modules only
@@ -72,6 +72,7 @@ public:
     unsigned numlines;  // number of lines in source file
     FileType filetype;  // source file type
     d_bool hasAlwaysInlines; // contains references to functions that must be inlined
+    d_bool bodiesUsed;       // function bodies were interpreted by CTFE or inlined elsewhere
     d_bool isPackageFile; // if it is a package.d
     Edition edition;    // language edition that this module is compiled with
     Package *pkg;       // if isPackageFile is true, the Package that contains this package.d
@@ -88,6 +89,8 @@ public:
     Identifier *searchCacheIdent;
     Dsymbol *searchCacheSymbol; // cached value of search
     SearchOptFlags searchCacheFlags;       // cached flags
+    void *searchCache;          // earlier results of search
+    unsigned searchCacheGeneration; // value of searchGeneration when the caches were filled
     d_bool insearch;
 
     d_bool isExplicitlyOutOfBinary; // Is this module known to be out of binary, and must be DllImport'd?